@@ -14,6 +14,8 @@
  * - Interfaz gráfica con colores y sonidos
  * - Validación completa de entrada de datos
  * - Resumen estadístico de resultados
+ * - Exportación de resultados a CSV y formato binario
+ * - Boletos de sistema (7 a 15 números) liquidados sin expandir combinaciones
  * 
  * Autor: Diogo Pinzon - 8-1035-2187, Joseph Ibarguen 8-1040-1107 y Valentín Sáez 3-757-2165
  * Fecha: 07/18/2025
@@ -28,6 +30,7 @@
 
 #include <stdio.h>      // Funciones estándar de entrada/salida (printf, scanf)
 #include <stdlib.h>     // Funciones de utilidad general (system, srand, rand)
+#include <string.h>     // Manejo de memoria y cadenas (memcpy, memset)
 #include <conio.h>      // Funciones de consola específicas de Windows
 #include <time.h>       // Funciones de tiempo (time, para semilla aleatoria)
 #include <windows.h>    // API de Windows (colores, títulos, configuración)
@@ -41,6 +44,22 @@
 #define NUMEROS_POR_BOLETO 6    // Cantidad de números por boleto
 #define NUMERO_MIN 1            // Número mínimo válido
 #define NUMERO_MAX 38           // Número máximo válido
+#define NUM_PARTICIONES 2       // Particiones en que se divide la liquidación de boletos
+#define MAX_BOLETOS_SISTEMA 10  // Máximo número de boletos de sistema
+#define MIN_NUMEROS_SISTEMA 7   // Mínimo de números marcados en un boleto de sistema
+#define MAX_NUMEROS_SISTEMA 15  // Máximo de números marcados en un boleto de sistema
+#define TECLA_ESPECIAL 0x100    // Marca de leerTecla() para flechas, F1-F12 y Alt+tecla
+
+// ============================================================================
+// CONSTANTES DE EXPORTACIÓN
+// ============================================================================
+
+#define ARCHIVO_CSV "resultados.csv"        // Archivo de exportación en texto (CSV)
+#define ARCHIVO_CSV_SISTEMA "resultados_sistema.csv" // Exportación CSV de boletos de sistema
+#define ARCHIVO_BINARIO "resultados.bin"    // Archivo de exportación en formato binario
+#define FIRMA_BINARIO "LOTO"                // Firma de 4 bytes al inicio del archivo binario
+#define VERSION_BINARIO 2                   // Versión del formato binario
+#define TAM_BUFFER_EXPORTACION 65536        // Tamaño del buffer de escritura (64 KB)
 
 // ============================================================================
 // CÓDIGOS DE COLORES PARA LA CONSOLA DE WINDOWS
@@ -89,6 +108,35 @@ double premios[MAX_BOLETOS];
  */
 int cantidadBoletos = 0;
 
+/**
+ * Boletos de sistema: cada uno marca de 7 a 15 números y equivale a todas
+ * las combinaciones de 6 números posibles entre ellos
+ * Se guardan como máscara de bits: el bit n está activo si se marcó el número n
+ * Ejemplo: {1, 5, 9} -> (1 << 1) | (1 << 5) | (1 << 9)
+ */
+unsigned long long boletosSistema[MAX_BOLETOS_SISTEMA];
+
+/**
+ * Cantidad de números marcados en cada boleto de sistema (7-15)
+ */
+int marcadosSistema[MAX_BOLETOS_SISTEMA];
+
+/**
+ * Cantidad de números ganadores entre los marcados de cada boleto de sistema
+ */
+int aciertosSistema[MAX_BOLETOS_SISTEMA];
+
+/**
+ * Premio total de cada boleto de sistema (suma de todas sus combinaciones)
+ */
+double premiosSistema[MAX_BOLETOS_SISTEMA];
+
+/**
+ * Contador de boletos de sistema ingresados actualmente
+ * Rango: 0 a MAX_BOLETOS_SISTEMA
+ */
+int cantidadBoletosSistema = 0;
+
 /**
  * Flag que indica si ya se ingresaron los números ganadores
  * 0 = No ingresados, 1 = Ya ingresados
@@ -111,6 +159,21 @@ int ganadoresIngresados = 0;
  */
 double tablaPremios[7] = {0.00, 0.00, 0.00, 5.00, 50.00, 1500.00, 500000.00};
 
+// ============================================================================
+// ESTRUCTURAS DE DATOS
+// ============================================================================
+
+/**
+ * Resultado de liquidar un rango de boletos
+ * Los resultados parciales de cada partición se combinan en uno total
+ */
+typedef struct {
+    int histograma[NUMEROS_POR_BOLETO + 1]; // histograma[k] = boletos con k aciertos
+    int ganadores;                          // Boletos con premio mayor a cero
+    int listaGanadores[MAX_BOLETOS];        // Índices de los boletos ganadores
+    double totalPremios;                    // Suma de premios del rango
+} ResultadoLiquidacion;
+
 // ============================================================================
 // PROTOTIPOS DE FUNCIONES
 // ============================================================================
@@ -121,11 +184,32 @@ void mostrarBanner();                        // Muestra el banner principal con
 void mostrarMenu();                          // Muestra el menú principal de opciones
 void mostrarReglas();                        // Muestra las reglas del juego
 void pausarPantalla();                       // Pausa la ejecución esperando tecla
+int leerTecla();                             // Lee una tecla sin esperar Enter
 void ingresarGanadores();                    // Permite ingresar los números ganadores
 void ingresarBoletos();                      // Permite ingresar boletos de jugadores
 void mostrarResumen();                       // Muestra resumen de resultados
+void mostrarResumenSimples(const ResultadoLiquidacion *resultado); // Detalle de boletos simples
+void mostrarResumenSistema(const ResultadoLiquidacion *resultado); // Detalle de boletos de sistema
 void reproducirSonido(int tipo);             // Reproduce diferentes tipos de sonidos
 void mostrarNumeros(int nums[], int cantidad); // Muestra números con formato especial
+int contarAciertos(int boleto[]);            // Cuenta los aciertos de un boleto
+void liquidarRango(int inicio, int fin, int aciertosRango[], double premiosRango[],
+                   ResultadoLiquidacion *resultado); // Liquida un rango de boletos
+void combinarResultados(ResultadoLiquidacion *total, const ResultadoLiquidacion *parcial); // Suma un resultado parcial
+void liquidarBoletos(ResultadoLiquidacion *total); // Liquida todos los boletos por particiones
+void ingresarBoletosSistema();               // Permite ingresar boletos de sistema
+unsigned long long mascaraGanadores();       // Máscara de bits de los números ganadores
+int contarBits(unsigned long long mascara);  // Cuenta los bits activos de una máscara
+int numerosDeMascara(unsigned long long mascara, int nums[]); // Convierte una máscara en array
+long long combinaciones(int n, int k);       // Coeficiente binomial C(n, k)
+long long combinacionesConAciertos(int marcados, int aciertosMarcados, int k); // Combinaciones con k aciertos
+double calcularPremioSistema(int marcados, int aciertosMarcados); // Premio de un boleto de sistema
+void liquidarBoletosSistema(ResultadoLiquidacion *total); // Liquida todos los boletos de sistema
+void exportarResultados();                   // Exporta los resultados a CSV y binario
+int exportarCSV(const char *ruta);           // Escribe los resultados en formato CSV
+int exportarCSVSistema(const char *ruta);    // Escribe los boletos de sistema en formato CSV
+int exportarBinario(const char *ruta);       // Escribe los resultados en formato binario
+void escribirLittleEndian(unsigned char *destino, unsigned long long valor, int bytes); // Empaqueta un entero
 
 // ============================================================================
 // FUNCIÓN PRINCIPAL
@@ -148,7 +232,7 @@ int main() {
     // Inicializar generador de números aleatorios con la hora actual
     srand(time(NULL));
     
-    int opcion; // Variable para almacenar la opción seleccionada
+    int opcion; // Tecla de la opción seleccionada
     
     // Bucle principal del programa
     do {
@@ -162,32 +246,36 @@ int main() {
         // Solicitar opción al usuario
         printf("\n  Seleccione una opción: ");
         
-        // Validar entrada numérica
-        if (scanf("%d", &opcion) != 1) {
-            printf("  Error: Ingrese un número válido\n");
-            // Limpiar buffer de entrada para evitar bucles infinitos
-            while(getchar() != '\n');
-            continue;
-        }
+        // Leer una sola tecla: no hace falta presionar Enter
+        opcion = leerTecla();
         
-        // Limpiar buffer después de scanf
-        while(getchar() != '\n');
+        // Mostrar la tecla solo si es un carácter imprimible
+        if(opcion >= ' ' && opcion <= '~') {
+            printf("%c", opcion);
+        }
+        printf("\n");
         
         // Procesar la opción seleccionada
         switch(opcion) {
-            case 1: 
+            case '1': 
                 ingresarGanadores();
                 break;
-            case 2: 
+            case '2': 
                 ingresarBoletos();
                 break;
-            case 3: 
+            case '3': 
                 mostrarResumen();
                 break;
-            case 4: 
+            case '4': 
                 mostrarReglas();
                 break;
-            case 5: 
+            case '5': 
+                exportarResultados();
+                break;
+            case '6': 
+                ingresarBoletosSistema();
+                break;
+            case '7': 
                 // Despedida del programa
                 mostrarBanner();
                 printf("\n  Gracias por usar el simulador. ¡Buena suerte!\n");
@@ -299,8 +387,18 @@ cambiarColor(COLOR_VERDE);
     cambiarColor(COLOR_MAGENTA);
     printf("    ║\n");
     printf("  ║  ");
+cambiarColor(COLOR_VERDE);
+    printf("    5. Exportar resultados              ");
+    cambiarColor(COLOR_MAGENTA);
+    printf("    ║\n");
+    printf("  ║  ");
+cambiarColor(COLOR_VERDE);
+    printf("    6. Boletos de sistema               ");
+    cambiarColor(COLOR_MAGENTA);
+    printf("    ║\n");
+    printf("  ║  ");
 cambiarColor(COLOR_ROJO);
-    printf("    5. Salir                            ");
+    printf("    7. Salir                            ");
     cambiarColor(COLOR_MAGENTA);
     printf("    ║\n");
     printf("  ║                                              ║\n");
@@ -315,10 +413,28 @@ cambiarColor(COLOR_ROJO);
 void pausarPantalla() {
     printf("\n  ");
     cambiarColor(8); // Color gris
-    system("pause"); // Comando de Windows para pausar
+    printf("Presione una tecla para continuar . . .");
+    leerTecla(); // Leer directamente de la consola, sin lanzar cmd.exe
+    printf("\n");
     cambiarColor(COLOR_BLANCO);
 }
 
+/**
+ * Lee una tecla directamente de la consola sin esperar Enter ni mostrarla
+ * Las teclas especiales (flechas, F1-F12, Alt+tecla) llegan como dos
+ * códigos; se devuelve el segundo marcado con TECLA_ESPECIAL para que no
+ * se confunda con un carácter normal (ejemplo: Alt+N llega como 0, '1')
+ * 
+ * @return Código de la tecla presionada, o TECLA_ESPECIAL | código
+ */
+int leerTecla() {
+    int tecla = _getch();
+    if(tecla == 0 || tecla == 0xE0) {
+        tecla = TECLA_ESPECIAL | _getch(); // Segundo código de una tecla especial
+    }
+    return tecla;
+}
+
 // ============================================================================
 // FUNCIONES DE LÓGICA DE NEGOCIO
 // ============================================================================
@@ -496,15 +612,7 @@ void ingresarBoletos() {
         
         // CÁLCULO DE ACIERTOS
         // Contar cuántos números del boleto coinciden con los ganadores
-        aciertos[cantidadBoletos] = 0;
-        for(int i = 0; i < NUMEROS_POR_BOLETO; i++) {
-            for(int j = 0; j < NUMEROS_POR_BOLETO; j++) {
-                if(boletos[cantidadBoletos][i] == numerosGanadores[j]) {
-                    aciertos[cantidadBoletos]++;
-                    break; // Salir del bucle interno al encontrar coincidencia
-                }
-            }
-        }
+        aciertos[cantidadBoletos] = contarAciertos(boletos[cantidadBoletos]);
         
         // ASIGNACIÓN DE PREMIO
         // Usar la tabla de premios basada en el número de aciertos
@@ -548,6 +656,155 @@ void ingresarBoletos() {
     }
 }
 
+/**
+ * Permite ingresar boletos de sistema: el jugador marca de 7 a 15 números
+ * y juega todas las combinaciones de 6 entre ellos en un solo boleto
+ * El boleto se guarda como máscara de bits y se liquida sin expandirlo
+ */
+void ingresarBoletosSistema() {
+    // Limpiar pantalla y mostrar header
+    system("cls");
+    mostrarBanner();
+    
+    // Verificar que se hayan ingresado los números ganadores
+    if(!ganadoresIngresados) {
+        cambiarColor(COLOR_ROJO);
+        printf("\n  ¡Primero ingrese los números ganadores!\n");
+        cambiarColor(COLOR_BLANCO);
+        reproducirSonido(2); // Sonido de error
+        return;
+    }
+    
+    // Verificar que no se haya alcanzado el límite de boletos de sistema
+    if(cantidadBoletosSistema >= MAX_BOLETOS_SISTEMA) {
+        cambiarColor(COLOR_ROJO);
+        printf("\n  ¡Límite de boletos de sistema alcanzado (%d)!\n", MAX_BOLETOS_SISTEMA);
+        cambiarColor(COLOR_BLANCO);
+        reproducirSonido(2); // Sonido de error
+        return;
+    }
+    
+    // Bucle para ingresar cada boleto de sistema
+    while(cantidadBoletosSistema < MAX_BOLETOS_SISTEMA) {
+        system("cls");
+        mostrarBanner();
+        
+        cambiarColor(COLOR_MAGENTA);
+        printf("\n  ╔══════════════════════════════════════════════╗\n");
+        printf("  ║           INGRESO DE BOLETOS DE SISTEMA      ║\n");
+        printf("  ╚══════════════════════════════════════════════╝\n");
+        cambiarColor(COLOR_BLANCO);
+        
+        printf("  Boleto de sistema %d/%d\n", cantidadBoletosSistema + 1, MAX_BOLETOS_SISTEMA);
+        
+        // Preguntar cuántos números desea marcar
+        int marcados;
+        cambiarColor(COLOR_AZUL);
+        printf("\n  ¿Cuántos números desea marcar? (%d-%d): ",
+               MIN_NUMEROS_SISTEMA, MAX_NUMEROS_SISTEMA);
+        cambiarColor(COLOR_BLANCO);
+        if(scanf("%d", &marcados) != 1 ||
+           marcados < MIN_NUMEROS_SISTEMA || marcados > MAX_NUMEROS_SISTEMA) {
+            cambiarColor(COLOR_ROJO);
+            printf("  Cantidad no válida\n");
+            cambiarColor(COLOR_BLANCO);
+            while(getchar() != '\n');
+            return;
+        }
+        
+        // Ingresar los números marcados directamente en la máscara
+        unsigned long long mascara = 0;
+        for(int i = 0; i < marcados; i++) {
+            int valido = 0;
+            
+            while(!valido) {
+                int numero;
+                printf("  Número %d/%d: ", i+1, marcados);
+                
+                // Validar entrada numérica
+                if(scanf("%d", &numero) != 1) {
+                    printf("  Error: Ingrese un número válido\n");
+                    while(getchar() != '\n');
+                    continue;
+                }
+                
+                // Validar rango
+                if(numero < NUMERO_MIN || numero > NUMERO_MAX) {
+                    printf("  Número fuera de rango (1-38)\n");
+                    continue;
+                }
+                
+                // Verificar duplicados: el bit ya está activo
+                if(mascara & (1ULL << numero)) {
+                    printf("  Número duplicado en este boleto\n");
+                    continue;
+                }
+                
+                // Número válido
+                valido = 1;
+                mascara |= 1ULL << numero;
+                cambiarColor(COLOR_VERDE);
+                printf("  Número %d recibido correctamente ✔\n", numero);
+                cambiarColor(COLOR_BLANCO);
+                reproducirSonido(1);
+            }
+        }
+        
+        // LIQUIDACIÓN DEL BOLETO
+        // Los aciertos salen de la intersección con la máscara ganadora
+        int indice = cantidadBoletosSistema;
+        boletosSistema[indice] = mascara;
+        marcadosSistema[indice] = marcados;
+        aciertosSistema[indice] = contarBits(mascara & mascaraGanadores());
+        premiosSistema[indice] = calcularPremioSistema(marcados, aciertosSistema[indice]);
+        cantidadBoletosSistema++;
+        
+        // MOSTRAR RESULTADO DEL BOLETO
+        int nums[MAX_NUMEROS_SISTEMA];
+        printf("\n  Números marcados: ");
+        mostrarNumeros(nums, numerosDeMascara(mascara, nums));
+        
+        printf("\n  Combinaciones jugadas: %lld\n", combinaciones(marcados, NUMEROS_POR_BOLETO));
+        printf("  Aciertos: %d - Premio: $%.2f\n",
+               aciertosSistema[indice], premiosSistema[indice]);
+        
+        // Detalle de combinaciones premiadas por nivel de aciertos
+        for(int k = NUMEROS_POR_BOLETO; k >= 0; k--) {
+            long long cantidad = combinacionesConAciertos(marcados, aciertosSistema[indice], k);
+            if(cantidad > 0 && tablaPremios[k] > 0) {
+                printf("    %lld combinaciones con %d aciertos x $%.2f\n",
+                       cantidad, k, tablaPremios[k]);
+            }
+        }
+        
+        // Mostrar mensaje especial para ganadores
+        if(premiosSistema[indice] > 0) {
+            cambiarColor(COLOR_VERDE);
+            printf("  ¡FELICIDADES! Has ganado un premio\n");
+            cambiarColor(COLOR_BLANCO);
+            reproducirSonido(3);
+            
+            // Mensaje especial para el premio mayor
+            if(aciertosSistema[indice] == NUMEROS_POR_BOLETO) {
+                cambiarColor(COLOR_ROJO);
+                printf("  ¡¡¡PREMIO MAYOR!!!\n");
+                cambiarColor(COLOR_BLANCO);
+                reproducirSonido(5);
+            }
+        }
+        
+        // Preguntar si desea continuar (solo si quedan espacios)
+        if(cantidadBoletosSistema < MAX_BOLETOS_SISTEMA) {
+            char respuesta;
+            printf("\n  ¿Desea ingresar otro boleto de sistema? (s/n): ");
+            scanf(" %c", &respuesta);
+            if(respuesta != 's' && respuesta != 'S') {
+                return;
+            }
+        }
+    }
+}
+
 /**
  * Muestra un resumen completo de todos los resultados
  * Incluye estadísticas generales y detalles de cada boleto
@@ -579,15 +836,41 @@ void mostrarResumen() {
     printf("\n\n");
     
     // Verificar si hay boletos registrados
-    if(cantidadBoletos == 0) {
+    if(cantidadBoletos == 0 && cantidadBoletosSistema == 0) {
         printf("  No hay boletos registrados\n");
         return;
     }
     
-    // Variables para estadísticas
-    double totalPremios = 0;
-    int ganadores = 0;
+    // Liquidar todos los boletos contra los números ganadores actuales
+    ResultadoLiquidacion resultado;
+    liquidarBoletos(&resultado);
+    
+    ResultadoLiquidacion resultadoSistema;
+    liquidarBoletosSistema(&resultadoSistema);
     
+    if(cantidadBoletos > 0) {
+        mostrarResumenSimples(&resultado);
+    }
+    
+    if(cantidadBoletosSistema > 0) {
+        mostrarResumenSistema(&resultadoSistema);
+    }
+    
+    // Total combinado solo cuando hay ambos tipos de boleto
+    if(cantidadBoletos > 0 && cantidadBoletosSistema > 0) {
+        cambiarColor(COLOR_AMARILLO);
+        printf("\n  TOTAL GENERAL EN PREMIOS: $%.2f\n",
+               resultado.totalPremios + resultadoSistema.totalPremios);
+        cambiarColor(COLOR_BLANCO);
+    }
+}
+
+/**
+ * Muestra el detalle y las estadísticas de los boletos simples
+ * 
+ * @param resultado Resultado de la liquidación de los boletos simples
+ */
+void mostrarResumenSimples(const ResultadoLiquidacion *resultado) {
     // Mostrar detalles de cada boleto
     for(int i = 0; i < cantidadBoletos; i++) {
         printf("  Boleto %d: ", i+1);
@@ -597,8 +880,6 @@ void mostrarResumen() {
         
         // Marcar ganadores
         if(premios[i] > 0) {
-            ganadores++;
-            totalPremios += premios[i];
             cambiarColor(COLOR_VERDE);
             printf(" (GANADOR)");
             cambiarColor(COLOR_BLANCO);
@@ -609,8 +890,60 @@ void mostrarResumen() {
     // MOSTRAR ESTADÍSTICAS GENERALES
     printf("\n  ESTADÍSTICAS:\n");
     printf("  - Boletos jugados: %d\n", cantidadBoletos);
-    printf("  - Boletos ganadores: %d\n", ganadores);
-    printf("  - Total en premios: $%.2f\n", totalPremios);
+    printf("  - Boletos ganadores: %d", resultado->ganadores);
+    for(int i = 0; i < resultado->ganadores; i++) {
+        printf(i == 0 ? " (#%d" : ", #%d", resultado->listaGanadores[i] + 1);
+    }
+    printf(resultado->ganadores > 0 ? ")\n" : "\n");
+    printf("  - Total en premios: $%.2f\n", resultado->totalPremios);
+    
+    // Distribución de boletos por cantidad de aciertos
+    printf("\n  DISTRIBUCIÓN DE ACIERTOS:\n");
+    for(int k = NUMEROS_POR_BOLETO; k >= 0; k--) {
+        printf("  - %d aciertos: %d boletos\n", k, resultado->histograma[k]);
+    }
+}
+
+/**
+ * Muestra el detalle y las estadísticas de los boletos de sistema
+ * La distribución de aciertos se expresa en combinaciones de 6 números
+ * 
+ * @param resultado Resultado de la liquidación de los boletos de sistema
+ */
+void mostrarResumenSistema(const ResultadoLiquidacion *resultado) {
+    int nums[MAX_NUMEROS_SISTEMA];  // Números marcados del boleto actual
+    long long totalCombinaciones = 0;
+    
+    printf("\n  BOLETOS DE SISTEMA:\n");
+    for(int i = 0; i < cantidadBoletosSistema; i++) {
+        int cantidad = numerosDeMascara(boletosSistema[i], nums);
+        long long combinacionesBoleto = combinaciones(cantidad, NUMEROS_POR_BOLETO);
+        totalCombinaciones += combinacionesBoleto;
+        
+        printf("  Sistema %d: ", i+1);
+        mostrarNumeros(nums, cantidad);
+        printf("\n    %lld combinaciones - Aciertos: %d - Premio: $%.2f",
+               combinacionesBoleto, aciertosSistema[i], premiosSistema[i]);
+        
+        // Marcar ganadores
+        if(premiosSistema[i] > 0) {
+            cambiarColor(COLOR_VERDE);
+            printf(" (GANADOR)");
+            cambiarColor(COLOR_BLANCO);
+        }
+        printf("\n");
+    }
+    
+    printf("\n  ESTADÍSTICAS DE SISTEMA:\n");
+    printf("  - Boletos de sistema: %d\n", cantidadBoletosSistema);
+    printf("  - Combinaciones cubiertas: %lld\n", totalCombinaciones);
+    printf("  - Boletos ganadores: %d\n", resultado->ganadores);
+    printf("  - Total en premios: $%.2f\n", resultado->totalPremios);
+    
+    printf("\n  DISTRIBUCIÓN DE ACIERTOS (COMBINACIONES):\n");
+    for(int k = NUMEROS_POR_BOLETO; k >= 0; k--) {
+        printf("  - %d aciertos: %d combinaciones\n", k, resultado->histograma[k]);
+    }
 }
 
 /**
@@ -631,7 +964,10 @@ void mostrarReglas() {
     // Reglas básicas
     printf("  - Seleccione 6 números diferentes (1-38)\n");
     printf("  - No se permiten números repetidos\n");
-    printf("  - Premios por 3, 4, 5 o 6 aciertos\n\n");
+    printf("  - Premios por 3, 4, 5 o 6 aciertos\n");
+    printf("  - Boleto de sistema: marque de %d a %d números y juegue\n",
+           MIN_NUMEROS_SISTEMA, MAX_NUMEROS_SISTEMA);
+    printf("    todas las combinaciones de 6 entre ellos\n\n");
     
     // Tabla de premios
     printf("  TABLA DE PREMIOS:\n");
@@ -645,6 +981,469 @@ void mostrarReglas() {
     cambiarColor(COLOR_BLANCO);
 }
 
+// ============================================================================
+// FUNCIONES DE LIQUIDACIÓN
+// ============================================================================
+
+/**
+ * Cuenta cuántos números de un boleto coinciden con los números ganadores
+ * 
+ * @param boleto Array con los 6 números del boleto
+ * @return Cantidad de aciertos (0-6)
+ */
+int contarAciertos(int boleto[]) {
+    int cantidad = 0;
+    for(int i = 0; i < NUMEROS_POR_BOLETO; i++) {
+        for(int j = 0; j < NUMEROS_POR_BOLETO; j++) {
+            if(boleto[i] == numerosGanadores[j]) {
+                cantidad++;
+                break; // Salir del bucle interno al encontrar coincidencia
+            }
+        }
+    }
+    return cantidad;
+}
+
+/**
+ * Liquida los boletos en el rango [inicio, fin): calcula aciertos y
+ * premios de cada boleto y acumula las estadísticas del rango
+ * 
+ * La función no modifica el estado global: los resultados por boleto se
+ * escriben en los buffers del llamador, de modo que cada rango es
+ * independiente y su resultado contiene todo lo necesario para combinarlo
+ * 
+ * @param inicio Índice del primer boleto del rango
+ * @param fin Índice siguiente al último boleto del rango
+ * @param aciertosRango Buffer de (fin - inicio) posiciones para los aciertos
+ * @param premiosRango Buffer de (fin - inicio) posiciones para los premios
+ * @param resultado Estructura donde se guardan las estadísticas del rango
+ */
+void liquidarRango(int inicio, int fin, int aciertosRango[], double premiosRango[],
+                   ResultadoLiquidacion *resultado) {
+    memset(resultado, 0, sizeof(*resultado));
+    
+    for(int i = inicio; i < fin; i++) {
+        int k = contarAciertos(boletos[i]);
+        aciertosRango[i - inicio] = k;
+        premiosRango[i - inicio] = tablaPremios[k];
+        
+        resultado->histograma[k]++;
+        if(tablaPremios[k] > 0) {
+            resultado->listaGanadores[resultado->ganadores++] = i;
+            resultado->totalPremios += tablaPremios[k];
+        }
+    }
+}
+
+/**
+ * Suma un resultado parcial al resultado total
+ * 
+ * @param total Resultado acumulado
+ * @param parcial Resultado de una partición
+ */
+void combinarResultados(ResultadoLiquidacion *total, const ResultadoLiquidacion *parcial) {
+    for(int k = 0; k <= NUMEROS_POR_BOLETO; k++) {
+        total->histograma[k] += parcial->histograma[k];
+    }
+    
+    // Agregar los ganadores del parcial al final de la lista
+    for(int i = 0; i < parcial->ganadores && total->ganadores < MAX_BOLETOS; i++) {
+        total->listaGanadores[total->ganadores++] = parcial->listaGanadores[i];
+    }
+    total->totalPremios += parcial->totalPremios;
+}
+
+/**
+ * Liquida todos los boletos registrados dividiéndolos en NUM_PARTICIONES
+ * rangos contiguos y combinando los resultados parciales
+ * Cada partición escribe sus resultados en su tramo de aciertos[] y premios[]
+ * 
+ * @param total Estructura donde se guarda el resultado combinado
+ */
+void liquidarBoletos(ResultadoLiquidacion *total) {
+    memset(total, 0, sizeof(*total));
+    
+    // Tamaño de cada partición, redondeado hacia arriba
+    int tamParticion = (cantidadBoletos + NUM_PARTICIONES - 1) / NUM_PARTICIONES;
+    
+    for(int p = 0; p < NUM_PARTICIONES; p++) {
+        int inicio = p * tamParticion;
+        int fin = inicio + tamParticion;
+        if(fin > cantidadBoletos) {
+            fin = cantidadBoletos;
+        }
+        if(inicio >= fin) {
+            break; // No quedan boletos para esta partición
+        }
+        
+        ResultadoLiquidacion parcial;
+        liquidarRango(inicio, fin, &aciertos[inicio], &premios[inicio], &parcial);
+        combinarResultados(total, &parcial);
+    }
+}
+
+/**
+ * Construye la máscara de bits de los números ganadores
+ * 
+ * @return Máscara con el bit n activo por cada número ganador n
+ */
+unsigned long long mascaraGanadores() {
+    unsigned long long mascara = 0;
+    for(int i = 0; i < NUMEROS_POR_BOLETO; i++) {
+        mascara |= 1ULL << numerosGanadores[i];
+    }
+    return mascara;
+}
+
+/**
+ * Cuenta cuántos bits están activos en una máscara
+ * 
+ * @param mascara Máscara de números
+ * @return Cantidad de números contenidos en la máscara
+ */
+int contarBits(unsigned long long mascara) {
+    int cantidad = 0;
+    while(mascara) {
+        mascara &= mascara - 1; // Apagar el bit activo más bajo
+        cantidad++;
+    }
+    return cantidad;
+}
+
+/**
+ * Convierte una máscara de bits en un array de números ordenado
+ * 
+ * @param mascara Máscara de números
+ * @param nums Array donde se escriben los números (al menos MAX_NUMEROS_SISTEMA)
+ * @return Cantidad de números escritos
+ */
+int numerosDeMascara(unsigned long long mascara, int nums[]) {
+    int cantidad = 0;
+    for(int n = NUMERO_MIN; n <= NUMERO_MAX; n++) {
+        if(mascara & (1ULL << n)) {
+            nums[cantidad++] = n;
+        }
+    }
+    return cantidad;
+}
+
+/**
+ * Calcula el coeficiente binomial C(n, k): formas de elegir k de n elementos
+ * 
+ * @param n Cantidad de elementos
+ * @param k Cantidad de elementos elegidos
+ * @return C(n, k), o 0 si k está fuera del rango 0..n
+ */
+long long combinaciones(int n, int k) {
+    if(k < 0 || k > n) {
+        return 0;
+    }
+    
+    long long resultado = 1;
+    for(int i = 1; i <= k; i++) {
+        // La división es exacta: resultado * (n-k+i) es múltiplo de i
+        resultado = resultado * (n - k + i) / i;
+    }
+    return resultado;
+}
+
+/**
+ * Cuenta las combinaciones de 6 números de un boleto de sistema que
+ * tienen exactamente k aciertos: C(h, k) * C(m - h, 6 - k)
+ * 
+ * @param marcados Cantidad de números marcados (m)
+ * @param aciertosMarcados Cantidad de números ganadores entre los marcados (h)
+ * @param k Cantidad de aciertos de la combinación
+ * @return Cantidad de combinaciones con k aciertos
+ */
+long long combinacionesConAciertos(int marcados, int aciertosMarcados, int k) {
+    return combinaciones(aciertosMarcados, k) *
+           combinaciones(marcados - aciertosMarcados, NUMEROS_POR_BOLETO - k);
+}
+
+/**
+ * Calcula el premio de un boleto de sistema sin expandir sus combinaciones
+ * Cada una de las combinaciones con k aciertos recibe tablaPremios[k]
+ * 
+ * @param marcados Cantidad de números marcados (m)
+ * @param aciertosMarcados Cantidad de números ganadores entre los marcados (h)
+ * @return Premio total del boleto
+ */
+double calcularPremioSistema(int marcados, int aciertosMarcados) {
+    double premio = 0;
+    for(int k = 0; k <= NUMEROS_POR_BOLETO; k++) {
+        premio += combinacionesConAciertos(marcados, aciertosMarcados, k) * tablaPremios[k];
+    }
+    return premio;
+}
+
+/**
+ * Liquida todos los boletos de sistema contra los números ganadores actuales
+ * El histograma cuenta combinaciones de 6 números, no boletos
+ * 
+ * @param total Estructura donde se guarda el resultado
+ */
+void liquidarBoletosSistema(ResultadoLiquidacion *total) {
+    memset(total, 0, sizeof(*total));
+    unsigned long long ganadora = mascaraGanadores();
+    
+    for(int i = 0; i < cantidadBoletosSistema; i++) {
+        int m = marcadosSistema[i];
+        int h = contarBits(boletosSistema[i] & ganadora);
+        
+        aciertosSistema[i] = h;
+        premiosSistema[i] = calcularPremioSistema(m, h);
+        
+        for(int k = 0; k <= NUMEROS_POR_BOLETO; k++) {
+            total->histograma[k] += (int)combinacionesConAciertos(m, h, k);
+        }
+        if(premiosSistema[i] > 0) {
+            if(total->ganadores < MAX_BOLETOS) {
+                total->listaGanadores[total->ganadores] = i;
+            }
+            total->ganadores++;
+            total->totalPremios += premiosSistema[i];
+        }
+    }
+}
+
+// ============================================================================
+// FUNCIONES DE EXPORTACIÓN
+// ============================================================================
+
+/**
+ * Exporta los resultados de todos los boletos a los archivos CSV y binario
+ * para que puedan ser procesados por sistemas externos (pagos, auditoría)
+ */
+void exportarResultados() {
+    // Limpiar pantalla y mostrar header
+    system("cls");
+    mostrarBanner();
+    
+    // Verificar prerrequisitos
+    if(!ganadoresIngresados) {
+        cambiarColor(COLOR_ROJO);
+        printf("\n  ¡Primero ingrese los números ganadores!\n");
+        cambiarColor(COLOR_BLANCO);
+        reproducirSonido(2);
+        return;
+    }
+    
+    // Título de la sección
+    cambiarColor(COLOR_MAGENTA);
+    printf("\n  ╔══════════════════════════════════════════════╗\n");
+    printf("  ║             EXPORTACIÓN DE RESULTADOS        ║\n");
+    printf("  ╚══════════════════════════════════════════════╝\n");
+    cambiarColor(COLOR_BLANCO);
+    
+    // Liquidar antes de exportar para reflejar los números ganadores actuales
+    ResultadoLiquidacion resultado;
+    liquidarBoletos(&resultado);
+    
+    ResultadoLiquidacion resultadoSistema;
+    liquidarBoletosSistema(&resultadoSistema);
+    
+    // Escribir todos los formatos y reportar el resultado
+    if(exportarCSV(ARCHIVO_CSV) && exportarCSVSistema(ARCHIVO_CSV_SISTEMA) &&
+       exportarBinario(ARCHIVO_BINARIO)) {
+        cambiarColor(COLOR_VERDE);
+        printf("  %d boletos exportados a %s y %s ✔\n",
+               cantidadBoletos, ARCHIVO_CSV, ARCHIVO_BINARIO);
+        printf("  %d boletos de sistema exportados a %s y %s ✔\n",
+               cantidadBoletosSistema, ARCHIVO_CSV_SISTEMA, ARCHIVO_BINARIO);
+        printf("  Boletos ganadores: %d - Total en premios: $%.2f\n",
+               resultado.ganadores + resultadoSistema.ganadores,
+               resultado.totalPremios + resultadoSistema.totalPremios);
+        cambiarColor(COLOR_BLANCO);
+        reproducirSonido(1);
+    } else {
+        cambiarColor(COLOR_ROJO);
+        printf("  Error: No se pudieron escribir los archivos de exportación\n");
+        cambiarColor(COLOR_BLANCO);
+        reproducirSonido(2);
+    }
+}
+
+/**
+ * Escribe los resultados en formato CSV, una fila por boleto:
+ * boleto,n1,n2,n3,n4,n5,n6,aciertos,premio
+ * 
+ * Cada fila se escribe directamente desde los arrays globales al buffer
+ * del archivo, sin construir una copia del reporte en memoria
+ * 
+ * @param ruta Ruta del archivo a crear
+ * @return 1 si la escritura fue exitosa, 0 en caso de error
+ */
+int exportarCSV(const char *ruta) {
+    static char buffer[TAM_BUFFER_EXPORTACION]; // Buffer de escritura del archivo
+    
+    FILE *archivo = fopen(ruta, "w");
+    if(archivo == NULL) {
+        return 0;
+    }
+    
+    // Usar un buffer grande para que el disco reciba bloques completos
+    setvbuf(archivo, buffer, _IOFBF, sizeof(buffer));
+    
+    // Encabezado de columnas
+    fprintf(archivo, "boleto,n1,n2,n3,n4,n5,n6,aciertos,premio\n");
+    
+    // Una fila por boleto
+    for(int i = 0; i < cantidadBoletos; i++) {
+        fprintf(archivo, "%d", i + 1);
+        for(int j = 0; j < NUMEROS_POR_BOLETO; j++) {
+            fprintf(archivo, ",%d", boletos[i][j]);
+        }
+        fprintf(archivo, ",%d,%.2f\n", aciertos[i], premios[i]);
+    }
+    
+    // Verificar errores de escritura antes de cerrar
+    int exito = !ferror(archivo);
+    if(fclose(archivo) != 0) {
+        exito = 0;
+    }
+    return exito;
+}
+
+/**
+ * Escribe los boletos de sistema en formato CSV, una fila por boleto:
+ * sistema,marcados,numeros,aciertos,combinaciones,premio
+ * La columna numeros lista los números marcados separados por guiones
+ * 
+ * @param ruta Ruta del archivo a crear
+ * @return 1 si la escritura fue exitosa, 0 en caso de error
+ */
+int exportarCSVSistema(const char *ruta) {
+    static char buffer[TAM_BUFFER_EXPORTACION]; // Buffer de escritura del archivo
+    int nums[MAX_NUMEROS_SISTEMA];              // Números marcados del boleto actual
+    
+    FILE *archivo = fopen(ruta, "w");
+    if(archivo == NULL) {
+        return 0;
+    }
+    
+    setvbuf(archivo, buffer, _IOFBF, sizeof(buffer));
+    
+    // Encabezado de columnas
+    fprintf(archivo, "sistema,marcados,numeros,aciertos,combinaciones,premio\n");
+    
+    // Una fila por boleto de sistema
+    for(int i = 0; i < cantidadBoletosSistema; i++) {
+        int cantidad = numerosDeMascara(boletosSistema[i], nums);
+        
+        fprintf(archivo, "%d,%d,", i + 1, marcadosSistema[i]);
+        for(int j = 0; j < cantidad; j++) {
+            fprintf(archivo, j == 0 ? "%d" : "-%d", nums[j]);
+        }
+        fprintf(archivo, ",%d,%lld,%.2f\n", aciertosSistema[i],
+                combinaciones(marcadosSistema[i], NUMEROS_POR_BOLETO), premiosSistema[i]);
+    }
+    
+    // Verificar errores de escritura antes de cerrar
+    int exito = !ferror(archivo);
+    if(fclose(archivo) != 0) {
+        exito = 0;
+    }
+    return exito;
+}
+
+/**
+ * Escribe un entero sin signo en formato little-endian
+ * 
+ * @param destino Buffer donde se escriben los bytes
+ * @param valor Valor a escribir
+ * @param bytes Cantidad de bytes a escribir (1-8)
+ */
+void escribirLittleEndian(unsigned char *destino, unsigned long long valor, int bytes) {
+    for(int b = 0; b < bytes; b++) {
+        destino[b] = (unsigned char)(valor >> (8 * b));
+    }
+}
+
+/**
+ * Escribe los resultados en formato binario compacto (little-endian)
+ * 
+ * Encabezado (19 bytes):
+ *   - Firma "LOTO" (4 bytes)
+ *   - Versión del formato (1 byte)
+ *   - Cantidad de boletos simples (4 bytes)
+ *   - Cantidad de boletos de sistema (4 bytes)
+ *   - Números ganadores (6 bytes, uno por número)
+ * 
+ * Registro por boleto simple (19 bytes), todos antes que los de sistema:
+ *   - Número de boleto (4 bytes)
+ *   - Números del boleto (6 bytes, uno por número)
+ *   - Aciertos (1 byte)
+ *   - Premio en centavos (8 bytes)
+ * 
+ * Registro por boleto de sistema (22 bytes):
+ *   - Número de boleto de sistema (4 bytes)
+ *   - Máscara de números marcados (8 bytes, bit n = número n)
+ *   - Cantidad de números marcados (1 byte)
+ *   - Aciertos entre los marcados (1 byte)
+ *   - Premio total en centavos (8 bytes)
+ * 
+ * @param ruta Ruta del archivo a crear
+ * @return 1 si la escritura fue exitosa, 0 en caso de error
+ */
+int exportarBinario(const char *ruta) {
+    static char buffer[TAM_BUFFER_EXPORTACION]; // Buffer de escritura del archivo
+    unsigned char registro[19];                 // Registro empaquetado de un boleto
+    unsigned char registroSistema[22];          // Registro empaquetado de un boleto de sistema
+    
+    FILE *archivo = fopen(ruta, "wb");
+    if(archivo == NULL) {
+        return 0;
+    }
+    
+    setvbuf(archivo, buffer, _IOFBF, sizeof(buffer));
+    
+    // ENCABEZADO
+    unsigned char encabezado[19];
+    memcpy(encabezado, FIRMA_BINARIO, 4);
+    encabezado[4] = VERSION_BINARIO;
+    escribirLittleEndian(&encabezado[5], (unsigned)cantidadBoletos, 4);
+    escribirLittleEndian(&encabezado[9], (unsigned)cantidadBoletosSistema, 4);
+    for(int j = 0; j < NUMEROS_POR_BOLETO; j++) {
+        encabezado[13 + j] = (unsigned char)numerosGanadores[j];
+    }
+    fwrite(encabezado, 1, sizeof(encabezado), archivo);
+    
+    // REGISTROS
+    for(int i = 0; i < cantidadBoletos; i++) {
+        unsigned id = (unsigned)(i + 1);
+        // Premio redondeado a centavos para evitar errores de punto flotante
+        unsigned long long centavos = (unsigned long long)(premios[i] * 100.0 + 0.5);
+        
+        escribirLittleEndian(&registro[0], id, 4);
+        for(int j = 0; j < NUMEROS_POR_BOLETO; j++) {
+            registro[4 + j] = (unsigned char)boletos[i][j];
+        }
+        registro[10] = (unsigned char)aciertos[i];
+        escribirLittleEndian(&registro[11], centavos, 8);
+        fwrite(registro, 1, sizeof(registro), archivo);
+    }
+    
+    // REGISTROS DE SISTEMA
+    for(int i = 0; i < cantidadBoletosSistema; i++) {
+        unsigned long long centavos = (unsigned long long)(premiosSistema[i] * 100.0 + 0.5);
+        
+        escribirLittleEndian(&registroSistema[0], (unsigned)(i + 1), 4);
+        escribirLittleEndian(&registroSistema[4], boletosSistema[i], 8);
+        registroSistema[12] = (unsigned char)marcadosSistema[i];
+        registroSistema[13] = (unsigned char)aciertosSistema[i];
+        escribirLittleEndian(&registroSistema[14], centavos, 8);
+        fwrite(registroSistema, 1, sizeof(registroSistema), archivo);
+    }
+    
+    // Verificar errores de escritura antes de cerrar
+    int exito = !ferror(archivo);
+    if(fclose(archivo) != 0) {
+        exito = 0;
+    }
+    return exito;
+}
+
 // ============================================================================
 // FUNCIONES DE MULTIMEDIA Y PRESENTACIÓN
 // ============================================================================